@@ -37,6 +37,7 @@
 
 #include "ExtractorApp.h"
 
+#include <chrono>
 #include <filesystem>
 #include <pqxx/pqxx>
 
@@ -1475,6 +1476,10 @@ TEST_F(ProcessFolderEndtoEnd, LoadLotsOfFiles)
                                     "--form-dir",
                                     SEC_DIRECTORY.string()};
 
+    // keep track of throughput so changes to the parsing path can be compared run to run.
+
+    std::chrono::duration<double> elapsed{0};
+
     try
     {
         ExtractorApp myApp(tokens);
@@ -1485,8 +1490,10 @@ TEST_F(ProcessFolderEndtoEnd, LoadLotsOfFiles)
         bool startup_OK = myApp.Startup();
         if (startup_OK)
         {
+            auto start_time = std::chrono::steady_clock::now();
             myApp.Run();
             myApp.Shutdown();
+            elapsed = std::chrono::steady_clock::now() - start_time;
         }
         else
         {
@@ -1505,7 +1512,13 @@ TEST_F(ProcessFolderEndtoEnd, LoadLotsOfFiles)
         spdlog::error("Something totally unexpected happened.");
     }
     // NOTE: there are 157 files which meet the scan criteria BUT 2 of them are duplicated and some error out
-    ASSERT_EQ(CountFilings(), 153);
+    auto filings_loaded = CountFilings();
+    if (elapsed.count() > 0)
+    {
+        std::cout << "Loaded: " << filings_loaded << " filings in: " << elapsed.count()
+                  << " seconds. files/sec: " << filings_loaded / elapsed.count() << '\n';
+    }
+    ASSERT_EQ(filings_loaded, 153);
 }
 
 TEST_F(ProcessFolderEndtoEnd, LoadLotsOfFilesWithLimit)
@@ -869,8 +869,13 @@ TEST_F(ValidateFolderFilters, VerifyFindAllXBRL)
         }
     });
 
+    // time the directory walk so changes to the XBRL probe can be compared run to run.
+
+    auto start_time = std::chrono::steady_clock::now();
     std::for_each(fs::recursive_directory_iterator(EDGAR_DIRECTORY.get()), fs::recursive_directory_iterator(),
                   test_file);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+    std::cout << "Found: " << files_with_XML << " files with XBRL in: " << elapsed.count() << " seconds.\n";
 
     ASSERT_EQ(files_with_XML, 159);
 }